@@ -111,32 +111,64 @@ std::unordered_map<std::string, double> InputProcessor::scoreIntensities(const s
     }
     return scores;
 }
+// Builds the inverted keyword -> emotion table once so tone similarity needs a single lookup per token
+EmotionKeywordIndex InputProcessor::buildKeywordIndex(
+    const std::unordered_map<std::string, std::unordered_set<std::string>>& emotionKeywords
+) {
+    EmotionKeywordIndex index;
+    index.emotions.reserve(emotionKeywords.size());
+    for (const auto& [emotion, keywords] : emotionKeywords) {
+        uint32_t id = static_cast<uint32_t>(index.emotions.size());
+        index.emotions.push_back(emotion);
+        // A keyword shared by several emotions gets one entry per emotion
+        for (const auto& kw : keywords) {
+            index.keywordToEmotions[kw].push_back(id);
+        }
+    }
+    return index;
+}
+
 // Computes tone similarity between input tokens and emotion keyword lists
 std::unordered_map<std::string, double> InputProcessor::computeToneSimilarity(
     const std::vector<std::string>& tokens,
-    const std::unordered_map<std::string, std::unordered_set<std::string>>& emotionKeywords
+    const EmotionKeywordIndex& index
 ) {
-    std::unordered_map<std::string, double> similarity;
     size_t tokenCount = tokens.size();
-    for (const auto& [emotion, keywords] : emotionKeywords) {
-        int matchCount = 0;
-        // Count how many input tokens match keywords associated with the emotion
-        for (const auto& word : tokens) {
-            if (keywords.count(word)) matchCount++;
-        }
+    size_t emotionCount = index.emotions.size();
 
-        if (matchCount == 0) {
-            // No overlap with this emotion
-            similarity[emotion] = 0.0; 
-            continue;
-        }
+    // Count how many input tokens match keywords associated with each emotion
+    std::vector<int> matchCounts(emotionCount, 0);
+    for (const auto& word : tokens) {
+        auto it = index.keywordToEmotions.find(word);
+        if (it == index.keywordToEmotions.end()) continue;
+        for (uint32_t id : it->second) matchCounts[id]++;
+    }
+
+    // Score every emotion from its count in one flat pass
+    std::vector<double> scores(emotionCount, 0.0);
+    for (size_t i = 0; i < emotionCount; ++i) {
+        // No overlap with this emotion
+        if (matchCounts[i] == 0) continue;
         // Ratio of matches to total tokens (smoothed with +1 to avoid div by 0)
-        double ratio = static_cast<double>(matchCount) / (tokenCount + 1);
+        double ratio = static_cast<double>(matchCounts[i]) / (tokenCount + 1);
         // Multiplier favors concentrated emotion keywords (but caps it)
-        double multiplier = std::min(static_cast<double>(tokenCount) / matchCount, 3.0);
+        double multiplier = std::min(static_cast<double>(tokenCount) / matchCounts[i], 3.0);
         // Final similarity score = density * intensity
-        similarity[emotion] = ratio * multiplier;
+        scores[i] = ratio * multiplier;
     }
 
+    std::unordered_map<std::string, double> similarity;
+    similarity.reserve(emotionCount);
+    for (size_t i = 0; i < emotionCount; ++i) {
+        similarity[index.emotions[i]] = scores[i];
+    }
     return similarity; // Map from emotion > tone similarity score
 }
+
+// Convenience overload that builds the keyword index on the fly
+std::unordered_map<std::string, double> InputProcessor::computeToneSimilarity(
+    const std::vector<std::string>& tokens,
+    const std::unordered_map<std::string, std::unordered_set<std::string>>& emotionKeywords
+) {
+    return computeToneSimilarity(tokens, buildKeywordIndex(emotionKeywords));
+}
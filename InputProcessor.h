@@ -3,6 +3,18 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <cstdint>
+
+/**
+ * Inverted keyword table: maps each keyword to the emotions that list it.
+ * Emotions are numbered by their position in `emotions`, and each keyword
+ * stores the indices of every emotion it belongs to, so shared keywords
+ * (e.g. "fearful" under both anxiety and fear) count toward all of them.
+ */
+struct EmotionKeywordIndex {
+    std::vector<std::string> emotions;
+    std::unordered_map<std::string, std::vector<uint32_t>> keywordToEmotions;
+};
 
 /**
  * InputProcessor is responsible for interpreting raw user input.
@@ -13,6 +25,13 @@ class InputProcessor {
 public:
      static std::vector<std::string> tokenize(const std::string& input);
      static std::unordered_map<std::string, double> scoreIntensities(const std::string& input);
+     static EmotionKeywordIndex buildKeywordIndex(
+        const std::unordered_map<std::string, std::unordered_set<std::string>>& emotionKeywords
+    );
+     static std::unordered_map<std::string, double> computeToneSimilarity(
+        const std::vector<std::string>& tokens,
+        const EmotionKeywordIndex& index
+    );
      static std::unordered_map<std::string, double> computeToneSimilarity(
         const std::vector<std::string>& tokens,
         const std::unordered_map<std::string, std::unordered_set<std::string>>& emotionKeywords
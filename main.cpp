@@ -17,10 +17,11 @@ int main() {
     EmotionGraph graph;
     graph.buildExpandedGraph();
 
-    // Step 4: Compute tone similarity
+    // Step 4: Compute tone similarity using the inverted keyword table
+    EmotionKeywordIndex keywordIndex = InputProcessor::buildKeywordIndex(graph.emotionKeywords);
     std::unordered_map<std::string, double> toneSim = InputProcessor::computeToneSimilarity(
         tokens,
-        graph.emotionKeywords
+        keywordIndex
     );
 
     // Step 5: Score top emotions using modified Dijkstra’s